@@ -273,6 +273,101 @@ ring_read_advance (ring_t *ring, ring_size_t size)
 }
 
 
+/** Reserve contiguous space in ring buffer for writing in place.
+    @param ring pointer to ring buffer structure
+    @param size maximum number of bytes wanted
+    @param span pointer to span to fill in
+    @return number of bytes reserved.  */
+ring_size_t
+ring_write_reserve (ring_t *ring, ring_size_t size, ring_span_t *span)
+{
+    int tmp;
+    ring_size_t count;
+    ring_size_t semi_num;
+
+    /* Determine number of free entries in ring buffer, limited by
+       the space before the end of the buffer.  RING_WRITE_NUM
+       leaves the slot before the out pointer free so this never
+       makes the buffer appear empty.  */
+    count = RING_WRITE_NUM (ring, tmp);
+    semi_num = ring->end - ring->in;
+    if (count > semi_num)
+        count = semi_num;
+    if (size > count)
+        size = count;
+
+    span->data = ring->in;
+    span->size = size;
+    return size;
+}
+
+
+/** Commit bytes previously written in place after ring_write_reserve.
+    @param ring pointer to ring buffer structure
+    @param size number of bytes to commit
+    @return number of bytes committed.  */
+ring_size_t
+ring_write_commit (ring_t *ring, ring_size_t size)
+{
+    ring_size_t count;
+
+    count = ring_write_num (ring);
+    if (size > count)
+        size = count;
+
+    ring_write_advance (ring, size);
+    return size;
+}
+
+
+/** Peek at the data available for reading without copying.
+    @param ring pointer to ring buffer structure
+    @param spans array of two spans to fill in
+    @return total number of bytes available for reading.  */
+ring_size_t
+ring_read_peek (ring_t *ring, ring_span_t spans[2])
+{
+    int tmp;
+    ring_size_t count;
+    ring_size_t semi_num;
+
+    count = RING_READ_NUM (ring, tmp);
+    semi_num = ring->end - ring->out;
+
+    spans[0].data = ring->out;
+    spans[1].data = ring->top;
+    if (count > semi_num)
+    {
+        spans[0].size = semi_num;
+        spans[1].size = count - semi_num;
+    }
+    else
+    {
+        spans[0].size = count;
+        spans[1].size = 0;
+    }
+    return count;
+}
+
+
+/** Consume bytes previously examined with ring_read_peek.
+    @param ring pointer to ring buffer structure
+    @param size number of bytes to consume
+    @return number of bytes consumed.  */
+ring_size_t
+ring_read_consume (ring_t *ring, ring_size_t size)
+{
+    ring_size_t count;
+
+    count = ring_read_num (ring);
+    if (size > count)
+        size = count;
+
+    ring_read_advance (ring, size);
+    return size;
+}
+
+
 /** Search for character in ring buffer. 
     @param ring pointer to ring buffer structure
     @param ch character to find
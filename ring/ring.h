@@ -17,6 +17,14 @@ extern "C" {
 typedef uint16_t ring_size_t;
 
 
+/** Contiguous region of ring buffer storage.  */
+typedef struct ring_span_struct
+{
+    char *data;                 /* Pointer to first byte of span.  */
+    ring_size_t size;           /* Number of bytes in span.  */
+} ring_span_t;
+
+
 /** Define ring buffer structure.  Unfortunately, since we need to
     statically allocate this structure we cannot make the structure
     opaque.  However, do not access the members directly.  They may
@@ -152,6 +160,45 @@ char *
 ring_read_advance (ring_t *ring, ring_size_t size);
 
 
+/** Reserve contiguous space in ring buffer for writing in place.
+    Nothing is made visible to the reader until ring_write_commit is
+    called.  This allows a producer (or DMA engine) to write directly
+    into the ring buffer storage.
+    @param ring pointer to ring buffer structure
+    @param size maximum number of bytes wanted
+    @param span pointer to span to fill in; span->size is set to
+           the number of contiguous bytes available (up to size)
+    @return number of bytes reserved.  */
+ring_size_t
+ring_write_reserve (ring_t *ring, ring_size_t size, ring_span_t *span);
+
+
+/** Commit bytes previously written in place after ring_write_reserve.
+    @param ring pointer to ring buffer structure
+    @param size number of bytes to commit (at most the number reserved)
+    @return number of bytes committed.  */
+ring_size_t
+ring_write_commit (ring_t *ring, ring_size_t size);
+
+
+/** Peek at the data available for reading without copying.  Since
+    the data may wrap, it is described by up to two spans.  The
+    second span has zero size if the data is contiguous.
+    @param ring pointer to ring buffer structure
+    @param spans array of two spans to fill in
+    @return total number of bytes available for reading.  */
+ring_size_t
+ring_read_peek (ring_t *ring, ring_span_t spans[2]);
+
+
+/** Consume bytes previously examined with ring_read_peek.
+    @param ring pointer to ring buffer structure
+    @param size number of bytes to consume
+    @return number of bytes consumed.  */
+ring_size_t
+ring_read_consume (ring_t *ring, ring_size_t size);
+
+
 /** Write single character to ring buffer.
     @param ring pointer to ring buffer structure
     @param c character to write
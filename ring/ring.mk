@@ -3,4 +3,4 @@ RING_DIR = $(DRIVER_DIR)/ring
 VPATH += $(RING_DIR)
 INCLUDES += -I$(RING_DIR) 
 
-SRC += ring.c
+SRC += ring.c ring_pow2.c
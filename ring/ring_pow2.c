@@ -0,0 +1,158 @@
+/** @file   ring_pow2.c
+    @author M. P. Hayes, UCECE
+    @date   17 October 2026
+    @brief  Power-of-two ring buffer implementation.
+*/
+
+#include <string.h>
+#include "ring_pow2.h"
+
+
+/** Initialise a power-of-two ring buffer structure to use a
+    specified buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size size of memory buffer in bytes (must be a power of two)
+    @return size size of memory buffer in bytes or zero if error.  */
+ring_pow2_size_t
+ring_pow2_init (ring_pow2_t *ring, void *buffer, ring_pow2_size_t size)
+{
+    if (!ring || !buffer)
+        return 0;
+
+    /* Reject zero and sizes that are not a power of two.  */
+    if (!size || (size & (size - 1)))
+        return 0;
+
+    ring->buffer = buffer;
+    ring->mask = size - 1;
+
+    ring_pow2_clear (ring);
+
+    return size;
+}
+
+
+/** Determine number of bytes in ring buffer ready for reading
+    without wrapping.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer ready for reading.  */
+ring_pow2_size_t
+ring_pow2_read_num_nowrap (ring_pow2_t *ring)
+{
+    uint32_t num;
+    uint32_t semi_num;
+
+    num = RING_POW2_READ_NUM (ring);
+    semi_num = RING_POW2_SIZE (ring) - (ring->out & ring->mask);
+
+    return num < semi_num ? num : semi_num;
+}
+
+
+/** Read from a power-of-two ring buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size maximum number of bytes to read
+    @return number of bytes actually read.  */
+ring_pow2_size_t
+ring_pow2_read (ring_pow2_t *ring, void *buffer, ring_pow2_size_t size)
+{
+    uint32_t count;
+    uint32_t offset;
+    uint32_t semi_num;
+    char *buf = buffer;
+
+    /* Determine number of entries in ring buffer.  */
+    count = RING_POW2_READ_NUM (ring);
+    if (size > count)
+        size = count;
+
+    /* Return if nothing to read.  */
+    if (!size)
+        return 0;
+
+    offset = ring->out & ring->mask;
+    semi_num = RING_POW2_SIZE (ring) - offset;
+
+    if (size > semi_num)
+    {
+        /* The data is split into two portions, so first read the
+           portion to the end of the ring buffer and then the
+           remainder from the start.  */
+        memcpy (buf, ring->buffer + offset, semi_num);
+        memcpy (buf + semi_num, ring->buffer, size - semi_num);
+    }
+    else
+    {
+        memcpy (buf, ring->buffer + offset, size);
+    }
+
+    /* Update output index.  */
+    ring->out += size;
+    return size;
+}
+
+
+/** Write to a power-of-two ring buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size number of bytes to write
+    @return number of bytes actually written.  */
+ring_pow2_size_t
+ring_pow2_write (ring_pow2_t *ring, const void *buffer, ring_pow2_size_t size)
+{
+    uint32_t count;
+    uint32_t offset;
+    uint32_t semi_num;
+    const char *buf = buffer;
+
+    /* Determine number of free entries in ring buffer.  */
+    count = RING_POW2_WRITE_NUM (ring);
+    if (size > count)
+        size = count;
+
+    /* Return if buffer full.  */
+    if (!size)
+        return 0;
+
+    offset = ring->in & ring->mask;
+    semi_num = RING_POW2_SIZE (ring) - offset;
+
+    if (size > semi_num)
+    {
+        /* The data is split into two portions, so first write the
+           portion to the end of the ring buffer and then the
+           remainder to the start.  */
+        memcpy (ring->buffer + offset, buf, semi_num);
+        memcpy (ring->buffer, buf + semi_num, size - semi_num);
+    }
+    else
+    {
+        memcpy (ring->buffer + offset, buf, size);
+    }
+
+    /* Update input index.  */
+    ring->in += size;
+    return size;
+}
+
+
+/** Search for character in ring buffer.
+    @param ring pointer to ring buffer structure
+    @param ch character to find
+    @return non-zero if character found.  */
+bool
+ring_pow2_find (ring_pow2_t *ring, char ch)
+{
+    uint32_t index;
+    uint32_t in;
+
+    in = ring->in;
+    for (index = ring->out; index != in; index++)
+    {
+        if (ring->buffer[index & ring->mask] == ch)
+            return 1;
+    }
+    return 0;
+}
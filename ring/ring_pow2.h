@@ -0,0 +1,198 @@
+/** @file   ring_pow2.h
+    @author M. P. Hayes, UCECE
+    @date   17 October 2026
+    @brief  Power-of-two ring buffer interface.
+*/
+
+#ifndef _RING_POW2_H
+#define _RING_POW2_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "config.h"
+
+typedef uint32_t ring_pow2_size_t;
+
+
+/** Define power-of-two ring buffer structure.  The buffer size must
+    be a power of two.  The in and out members are free-running
+    indices that are only masked when the buffer is accessed.  Thus
+    the number of bytes in the buffer is simply in - out (modulo
+    2^32) and all of the buffer can be used; unlike ring_t, no slot
+    is wasted to distinguish full from empty.  As with ring_t, the
+    in index is only modified by the writer and the out index is
+    only modified by the reader so these routines can be called by
+    an ISR without a race condition (provided 32-bit reads and
+    writes are atomic).  Do not access the members directly.  */
+typedef struct ring_pow2_struct
+{
+    uint32_t in;                /* Free-running write index.  */
+    uint32_t out;               /* Free-running read index.  */
+    uint32_t mask;              /* Buffer size - 1.  */
+    char *buffer;               /* Pointer to buffer.  */
+} ring_pow2_t;
+
+
+/** The following macros should be considered private.  */
+
+/** Number of bytes in ring buffer.  */
+#define RING_POW2_SIZE(RING) ((RING)->mask + 1)
+
+/** Number of bytes in ring buffer for reading.  Unsigned
+    subtraction handles wrap around of the free-running indices.  */
+#define RING_POW2_READ_NUM(RING) ((uint32_t)((RING)->in - (RING)->out))
+
+/** Number of free bytes in ring buffer for writing.  */
+#define RING_POW2_WRITE_NUM(RING) \
+   (RING_POW2_SIZE (RING) - RING_POW2_READ_NUM (RING))
+
+
+/** Initialise a power-of-two ring buffer structure to use a
+    specified buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size size of memory buffer in bytes (must be a power of two)
+    @return size size of memory buffer in bytes or zero if error.  */
+ring_pow2_size_t
+ring_pow2_init (ring_pow2_t *ring, void *buffer, ring_pow2_size_t size);
+
+
+/** Read from a power-of-two ring buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size maximum number of bytes to read
+    @return number of bytes actually read.  */
+ring_pow2_size_t
+ring_pow2_read (ring_pow2_t *ring, void *buffer, ring_pow2_size_t size);
+
+
+/** Write to a power-of-two ring buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size number of bytes to write
+    @return number of bytes actually written.  */
+ring_pow2_size_t
+ring_pow2_write (ring_pow2_t *ring, const void *buffer, ring_pow2_size_t size);
+
+
+/** Determine number of bytes in ring buffer ready for reading
+    without wrapping.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer ready for reading.  */
+ring_pow2_size_t
+ring_pow2_read_num_nowrap (ring_pow2_t *ring);
+
+
+/** Search for character in ring buffer.
+    @param ring pointer to ring buffer structure
+    @param ch character to find
+    @return non-zero if character found.  */
+bool
+ring_pow2_find (ring_pow2_t *ring, char ch);
+
+
+/** Determine number of bytes in ring buffer ready for reading.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer ready for reading.  */
+static inline ring_pow2_size_t
+ring_pow2_read_num (ring_pow2_t *ring)
+{
+    return RING_POW2_READ_NUM (ring);
+}
+
+
+/** Determine number of bytes in ring buffer free for writing.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer free for writing.  */
+static inline ring_pow2_size_t
+ring_pow2_write_num (ring_pow2_t *ring)
+{
+    return RING_POW2_WRITE_NUM (ring);
+}
+
+
+/** Return non-zero if the ring buffer is empty.  */
+static inline bool
+ring_pow2_empty_p (ring_pow2_t *ring)
+{
+    return RING_POW2_READ_NUM (ring) == 0;
+}
+
+
+/** Return non-zero if the ring buffer is full.  */
+static inline bool
+ring_pow2_full_p (ring_pow2_t *ring)
+{
+    return RING_POW2_WRITE_NUM (ring) == 0;
+}
+
+
+/** Write single character to ring buffer.  There is no wrap
+    test; the index is masked on access.
+    @param ring pointer to ring buffer structure
+    @param c character to write
+    @return non-zero if successful.  */
+static inline ring_pow2_size_t
+ring_pow2_putc (ring_pow2_t *ring, char c)
+{
+    uint32_t in;
+
+    in = ring->in;
+    if (in - ring->out > ring->mask)
+        return 0;
+
+    ring->buffer[in & ring->mask] = c;
+    ring->in = in + 1;
+    return 1;
+}
+
+
+/** Read single character from ring buffer.  There is no wrap
+    test; the index is masked on access.
+    @param ring pointer to ring buffer structure
+    @return character or -1 if unsuccessful.  */
+static inline int
+ring_pow2_getc (ring_pow2_t *ring)
+{
+    uint32_t out;
+    char c;
+
+    out = ring->out;
+    if (ring->in == out)
+        return -1;
+
+    c = ring->buffer[out & ring->mask];
+    ring->out = out + 1;
+    return c;
+}
+
+
+/** Peek at next character to read from ring buffer.
+    @param ring pointer to ring buffer structure
+    @return character or -1 if unsuccessful.  */
+static inline int
+ring_pow2_peek (ring_pow2_t *ring)
+{
+    if (ring->in == ring->out)
+        return -1;
+
+    return ring->buffer[ring->out & ring->mask];
+}
+
+
+/** Empties the ring buffer to it's original state.
+    @param ring, pointer to ring buffer structure. */
+static inline void
+ring_pow2_clear (ring_pow2_t *ring)
+{
+    ring->in = ring->out = 0;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
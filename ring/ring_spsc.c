@@ -0,0 +1,156 @@
+/** @file   ring_spsc.c
+    @author M. P. Hayes, UCECE
+    @date   17 October 2026
+    @brief  Single-producer/single-consumer ring buffer implementation.
+*/
+
+#include <string.h>
+#include "ring_spsc.h"
+
+
+/** Initialise a ring buffer structure to use a specified buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size size of memory buffer in bytes (must be a power of two)
+    @return size size of memory buffer in bytes or zero if error.  */
+ring_spsc_size_t
+ring_spsc_init (ring_spsc_t *ring, void *buffer, ring_spsc_size_t size)
+{
+    if (!ring || !buffer)
+        return 0;
+
+    /* Reject zero and sizes that are not a power of two.  */
+    if (!size || (size & (size - 1)))
+        return 0;
+
+    ring->buffer = buffer;
+    ring->mask = size - 1;
+    ring->out_cache = 0;
+    ring->in_cache = 0;
+    atomic_init (&ring->in, 0);
+    atomic_init (&ring->out, 0);
+
+    return size;
+}
+
+
+/** Determine number of bytes in ring buffer ready for reading.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer ready for reading.  */
+ring_spsc_size_t
+ring_spsc_read_num (ring_spsc_t *ring)
+{
+    RING_SPSC_LOAD_ACQUIRE (&ring->in, ring->in_cache);
+    return ring->in_cache - RING_SPSC_LOAD_OWN (&ring->out);
+}
+
+
+/** Determine number of bytes in ring buffer free for writing.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer free for writing.  */
+ring_spsc_size_t
+ring_spsc_write_num (ring_spsc_t *ring)
+{
+    RING_SPSC_LOAD_ACQUIRE (&ring->out, ring->out_cache);
+    return ring->mask + 1 - (RING_SPSC_LOAD_OWN (&ring->in) - ring->out_cache);
+}
+
+
+/** Write to a ring buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size number of bytes to write
+    @return number of bytes actually written.  */
+ring_spsc_size_t
+ring_spsc_write (ring_spsc_t *ring, const void *buffer, ring_spsc_size_t size)
+{
+    uint32_t in;
+    uint32_t count;
+    uint32_t offset;
+    uint32_t semi_num;
+    const char *buf = buffer;
+
+    in = RING_SPSC_LOAD_OWN (&ring->in);
+
+    /* Only reload the consumer's index if the cached copy does not
+       show enough free space.  */
+    count = ring->mask + 1 - (in - ring->out_cache);
+    if (size > count)
+    {
+        RING_SPSC_LOAD_ACQUIRE (&ring->out, ring->out_cache);
+        count = ring->mask + 1 - (in - ring->out_cache);
+        if (size > count)
+            size = count;
+    }
+
+    /* Return if buffer full.  */
+    if (!size)
+        return 0;
+
+    offset = in & ring->mask;
+    semi_num = ring->mask + 1 - offset;
+
+    if (size > semi_num)
+    {
+        memcpy (ring->buffer + offset, buf, semi_num);
+        memcpy (ring->buffer, buf + semi_num, size - semi_num);
+    }
+    else
+    {
+        memcpy (ring->buffer + offset, buf, size);
+    }
+
+    /* Publish the data to the consumer.  */
+    RING_SPSC_STORE_RELEASE (&ring->in, in + size);
+    return size;
+}
+
+
+/** Read from a ring buffer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size maximum number of bytes to read
+    @return number of bytes actually read.  */
+ring_spsc_size_t
+ring_spsc_read (ring_spsc_t *ring, void *buffer, ring_spsc_size_t size)
+{
+    uint32_t out;
+    uint32_t count;
+    uint32_t offset;
+    uint32_t semi_num;
+    char *buf = buffer;
+
+    out = RING_SPSC_LOAD_OWN (&ring->out);
+
+    /* Only reload the producer's index if the cached copy does not
+       show enough data.  */
+    count = ring->in_cache - out;
+    if (size > count)
+    {
+        RING_SPSC_LOAD_ACQUIRE (&ring->in, ring->in_cache);
+        count = ring->in_cache - out;
+        if (size > count)
+            size = count;
+    }
+
+    /* Return if nothing to read.  */
+    if (!size)
+        return 0;
+
+    offset = out & ring->mask;
+    semi_num = ring->mask + 1 - offset;
+
+    if (size > semi_num)
+    {
+        memcpy (buf, ring->buffer + offset, semi_num);
+        memcpy (buf + semi_num, ring->buffer, size - semi_num);
+    }
+    else
+    {
+        memcpy (buf, ring->buffer + offset, size);
+    }
+
+    /* Release the space to the producer.  */
+    RING_SPSC_STORE_RELEASE (&ring->out, out + size);
+    return size;
+}
@@ -0,0 +1,198 @@
+/** @file   ring_spsc.h
+    @author M. P. Hayes, UCECE
+    @date   17 October 2026
+    @brief  Single-producer/single-consumer ring buffer interface.
+*/
+
+#ifndef _RING_SPSC_H
+#define _RING_SPSC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "config.h"
+#include <stdatomic.h>
+
+typedef uint32_t ring_spsc_size_t;
+
+
+/** Define RING_SPSC_SMP to zero on single-core parts where the
+    producer and consumer are a task and an ISR.  The indices are
+    then accessed with plain loads and stores and only a compiler
+    barrier orders the buffer accesses.  Otherwise acquire/release
+    ordering is used so that the ring is safe when the producer and
+    consumer run on different cores (or host threads).  */
+#ifndef RING_SPSC_SMP
+#define RING_SPSC_SMP 1
+#endif
+
+
+/** Define RING_SPSC_CACHE_LINE to the cache line size to keep the
+    producer and consumer indices in separate cache lines.  This
+    avoids false sharing between cores but wastes RAM on parts
+    without a cache.  */
+#ifndef RING_SPSC_CACHE_LINE
+#define RING_SPSC_CACHE_LINE 0
+#endif
+
+
+/** Define ring buffer structure.  As with ring_pow2_t, the buffer
+    size must be a power of two and the indices are free-running.
+    The in index is only written by the producer and the out index
+    is only written by the consumer.  Each side keeps a private copy
+    of the other side's index and only reloads it (with acquire
+    ordering) when the copy suggests the buffer is full or empty.
+    Do not access the members directly.  */
+typedef struct ring_spsc_struct
+{
+    /* Producer side.  */
+    atomic_uint_least32_t in;   /* Free-running write index.  */
+    uint32_t out_cache;         /* Producer's copy of out.  */
+#if RING_SPSC_CACHE_LINE
+    char pad1[RING_SPSC_CACHE_LINE - 2 * sizeof (uint32_t)];
+#endif
+
+    /* Consumer side.  */
+    atomic_uint_least32_t out;  /* Free-running read index.  */
+    uint32_t in_cache;          /* Consumer's copy of in.  */
+#if RING_SPSC_CACHE_LINE
+    char pad2[RING_SPSC_CACHE_LINE - 2 * sizeof (uint32_t)];
+#endif
+
+    /* Read only after initialisation.  */
+    uint32_t mask;              /* Buffer size - 1.  */
+    char *buffer;               /* Pointer to buffer.  */
+} ring_spsc_t;
+
+
+/** The following macros should be considered private.  */
+
+#if RING_SPSC_SMP
+#define RING_SPSC_ACQUIRE memory_order_acquire
+#define RING_SPSC_RELEASE memory_order_release
+#define RING_SPSC_FENCE(ORDER)
+#else
+#define RING_SPSC_ACQUIRE memory_order_relaxed
+#define RING_SPSC_RELEASE memory_order_relaxed
+#define RING_SPSC_FENCE(ORDER) atomic_signal_fence (ORDER)
+#endif
+
+/** Load the other side's index.  */
+#define RING_SPSC_LOAD_ACQUIRE(PTR, RESULT)                            \
+    do {                                                               \
+        (RESULT) = atomic_load_explicit ((PTR), RING_SPSC_ACQUIRE);    \
+        RING_SPSC_FENCE (memory_order_acquire);                        \
+    } while (0)
+
+/** Publish our own index.  */
+#define RING_SPSC_STORE_RELEASE(PTR, VALUE)                            \
+    do {                                                               \
+        RING_SPSC_FENCE (memory_order_release);                        \
+        atomic_store_explicit ((PTR), (VALUE), RING_SPSC_RELEASE);     \
+    } while (0)
+
+/** Load our own index; no ordering is required.  */
+#define RING_SPSC_LOAD_OWN(PTR) \
+    atomic_load_explicit ((PTR), memory_order_relaxed)
+
+
+/** Initialise a ring buffer structure to use a specified buffer.
+    This must be called before the producer and consumer start.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size size of memory buffer in bytes (must be a power of two)
+    @return size size of memory buffer in bytes or zero if error.  */
+ring_spsc_size_t
+ring_spsc_init (ring_spsc_t *ring, void *buffer, ring_spsc_size_t size);
+
+
+/** Write to a ring buffer.  Only call from the producer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size number of bytes to write
+    @return number of bytes actually written.  */
+ring_spsc_size_t
+ring_spsc_write (ring_spsc_t *ring, const void *buffer, ring_spsc_size_t size);
+
+
+/** Read from a ring buffer.  Only call from the consumer.
+    @param ring pointer to ring buffer structure
+    @param buffer pointer to memory buffer
+    @param size maximum number of bytes to read
+    @return number of bytes actually read.  */
+ring_spsc_size_t
+ring_spsc_read (ring_spsc_t *ring, void *buffer, ring_spsc_size_t size);
+
+
+/** Determine number of bytes in ring buffer ready for reading.
+    Only call from the consumer.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer ready for reading.  */
+ring_spsc_size_t
+ring_spsc_read_num (ring_spsc_t *ring);
+
+
+/** Determine number of bytes in ring buffer free for writing.
+    Only call from the producer.
+    @param ring pointer to ring buffer structure
+    @return number of bytes in ring buffer free for writing.  */
+ring_spsc_size_t
+ring_spsc_write_num (ring_spsc_t *ring);
+
+
+/** Write single character to ring buffer.  Only call from the
+    producer.
+    @param ring pointer to ring buffer structure
+    @param c character to write
+    @return non-zero if successful.  */
+static inline ring_spsc_size_t
+ring_spsc_putc (ring_spsc_t *ring, char c)
+{
+    uint32_t in;
+
+    in = RING_SPSC_LOAD_OWN (&ring->in);
+    if (in - ring->out_cache > ring->mask)
+    {
+        /* Appears full so refresh copy of consumer's index.  */
+        RING_SPSC_LOAD_ACQUIRE (&ring->out, ring->out_cache);
+        if (in - ring->out_cache > ring->mask)
+            return 0;
+    }
+
+    ring->buffer[in & ring->mask] = c;
+    RING_SPSC_STORE_RELEASE (&ring->in, in + 1);
+    return 1;
+}
+
+
+/** Read single character from ring buffer.  Only call from the
+    consumer.
+    @param ring pointer to ring buffer structure
+    @return character or -1 if unsuccessful.  */
+static inline int
+ring_spsc_getc (ring_spsc_t *ring)
+{
+    uint32_t out;
+    char c;
+
+    out = RING_SPSC_LOAD_OWN (&ring->out);
+    if (ring->in_cache == out)
+    {
+        /* Appears empty so refresh copy of producer's index.  */
+        RING_SPSC_LOAD_ACQUIRE (&ring->in, ring->in_cache);
+        if (ring->in_cache == out)
+            return -1;
+    }
+
+    c = ring->buffer[out & ring->mask];
+    RING_SPSC_STORE_RELEASE (&ring->out, out + 1);
+    return c;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
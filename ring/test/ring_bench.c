@@ -0,0 +1,169 @@
+#include <stdint.h>
+
+typedef uint8_t bool;
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../ring.h"
+#include "../ring_pow2.h"
+
+/* Number of bytes to pass through each ring buffer.  */
+#define BYTES 50000000
+
+
+static double
+time_ns (void)
+{
+    struct timespec ts;
+
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+
+/* Emulate an ISR that fills the ring a byte at a time and a task
+   that empties it a byte at a time.  */
+static double
+ring_bench_char (ring_t *ring, unsigned int burst)
+{
+    double start;
+    unsigned long count = 0;
+    unsigned int sum = 0;
+    volatile unsigned int sink;
+
+    start = time_ns ();
+    while (count < BYTES)
+    {
+        unsigned int i;
+        int c;
+
+        for (i = 0; i < burst; i++)
+            ring_putc (ring, i);
+        while ((c = ring_getc (ring)) != -1)
+        {
+            sum += c;
+            count++;
+        }
+    }
+    sink = sum;
+    (void) sink;
+    return (time_ns () - start) / count;
+}
+
+
+static double
+ring_pow2_bench_char (ring_pow2_t *ring, unsigned int burst)
+{
+    double start;
+    unsigned long count = 0;
+    unsigned int sum = 0;
+    volatile unsigned int sink;
+
+    start = time_ns ();
+    while (count < BYTES)
+    {
+        unsigned int i;
+        int c;
+
+        for (i = 0; i < burst; i++)
+            ring_pow2_putc (ring, i);
+        while ((c = ring_pow2_getc (ring)) != -1)
+        {
+            sum += c;
+            count++;
+        }
+    }
+    sink = sum;
+    (void) sink;
+    return (time_ns () - start) / count;
+}
+
+
+static double
+ring_bench_block (ring_t *ring, char *buffer, unsigned int size)
+{
+    double start;
+    unsigned long count = 0;
+
+    start = time_ns ();
+    while (count < BYTES)
+    {
+        ring_write (ring, buffer, size);
+        count += ring_read (ring, buffer, size);
+    }
+    return (time_ns () - start) / count;
+}
+
+
+static double
+ring_pow2_bench_block (ring_pow2_t *ring, char *buffer, unsigned int size)
+{
+    double start;
+    unsigned long count = 0;
+
+    start = time_ns ();
+    while (count < BYTES)
+    {
+        ring_pow2_write (ring, buffer, size);
+        count += ring_pow2_read (ring, buffer, size);
+    }
+    return (time_ns () - start) / count;
+}
+
+
+int main (void)
+{
+    static const unsigned int sizes[] = {64, 256, 4096, 32768};
+    static const unsigned int xfers[] = {1, 7, 48, 500};
+    char *rbuffer;
+    char *buffer;
+    unsigned int i;
+    unsigned int j;
+
+    rbuffer = malloc (32768);
+    buffer = malloc (32768);
+    memset (buffer, 0x55, 32768);
+
+    printf ("%6s %6s %12s %12s %8s\n", "size", "xfer",
+            "ring ns/B", "pow2 ns/B", "speedup");
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+        for (j = 0; j < sizeof (xfers) / sizeof (xfers[0]); j++)
+        {
+            ring_t ring;
+            ring_pow2_t pring;
+            unsigned int xfer;
+            double t1;
+            double t2;
+
+            /* Leave room for the slot that ring_t wastes.  */
+            xfer = xfers[j] < sizes[i] ? xfers[j] : sizes[i] - 1;
+
+            ring_init (&ring, rbuffer, sizes[i]);
+            ring_pow2_init (&pring, rbuffer, sizes[i]);
+
+            /* Offset the indices so that transfers wrap.  */
+            ring_write_advance (&ring, sizes[i] / 2 + 1);
+            ring_read_advance (&ring, sizes[i] / 2 + 1);
+            pring.in = pring.out = sizes[i] / 2 + 1;
+
+            if (xfer < 16)
+            {
+                t1 = ring_bench_char (&ring, xfer);
+                t2 = ring_pow2_bench_char (&pring, xfer);
+                printf ("%6u %6u %12.3f %12.3f %8.2f  putc/getc\n",
+                        sizes[i], xfer, t1, t2, t1 / t2);
+            }
+            t1 = ring_bench_block (&ring, buffer, xfer);
+            t2 = ring_pow2_bench_block (&pring, buffer, xfer);
+            printf ("%6u %6u %12.3f %12.3f %8.2f  write/read\n",
+                    sizes[i], xfer, t1, t2, t1 / t2);
+        }
+    }
+
+    free (rbuffer);
+    free (buffer);
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <stdint.h>
+
+typedef uint8_t bool;
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../ring_pow2.h"
+
+#define N 1000000
+
+/* Use a buffer larger than ring_t can handle.  */
+#define M 131072
+
+
+int main (void)
+{
+    char *buffer1;
+    char *buffer2;
+    char *rbuffer;
+    ring_pow2_t ring;
+    int in = 0;
+    int out = 0;
+    int i;
+
+    srand (7);
+
+    buffer1 = malloc (N);
+    buffer2 = malloc (N);
+    rbuffer = malloc (M);
+
+    for (i = 0; i < N; i++)
+        buffer1[i] = i % 100;
+
+    if (ring_pow2_init (&ring, rbuffer, M - 1) != 0)
+    {
+        printf ("Accepted non power of two size\n");
+        return 1;
+    }
+    ring_pow2_init (&ring, rbuffer, M);
+
+    /* Check that all of the buffer can be used.  */
+    if (ring_pow2_write (&ring, buffer1, M + 1) != M
+        || !ring_pow2_full_p (&ring) || ring_pow2_putc (&ring, 0))
+    {
+        printf ("Full buffer not detected\n");
+        return 1;
+    }
+    ring_pow2_clear (&ring);
+
+    /* Start the indices near the wrap point.  */
+    ring.in = ring.out = 0xffffff00;
+
+    while ((in + 2 * M) < N)
+    {
+        int wsize;
+        int rsize;
+        int wbytes;
+        int rbytes;
+
+        wsize = rand () % (2 * M);
+        rsize = rand () % (2 * M);
+
+        wbytes = ring_pow2_write (&ring, &buffer1[in], wsize);
+
+        /* Mix in some single character transfers.  */
+        if (ring_pow2_putc (&ring, buffer1[in + wbytes]))
+            wbytes++;
+
+        rbytes = ring_pow2_read (&ring, &buffer2[out], rsize);
+        if (rbytes == rsize)
+        {
+            i = ring_pow2_getc (&ring);
+            if (i >= 0)
+                buffer2[out + rbytes++] = i;
+        }
+
+        if (memcmp (&buffer1[out], &buffer2[out], rbytes))
+        {
+            printf ("Mismatch at out %d\n", out);
+            return 1;
+        }
+
+        in += wbytes;
+        out += rbytes;
+
+        if (out > in || (uint32_t)(in - out) != ring_pow2_read_num (&ring))
+        {
+            printf ("out %d, in %d, count %u\n", out, in,
+                    ring_pow2_read_num (&ring));
+            return 1;
+        }
+    }
+
+    printf ("Transferred %d bytes\n", out);
+
+    free (buffer1);
+    free (buffer2);
+    free (rbuffer);
+
+    return 0;
+}
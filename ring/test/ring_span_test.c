@@ -0,0 +1,97 @@
+#include <stdint.h>
+
+typedef uint8_t bool;
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../ring.h"
+
+#define N 100000
+
+#define M 80
+
+
+int main (void)
+{
+    char *buffer1;
+    char *buffer2;
+    char *rbuffer;
+    ring_t ring;
+    int in = 0;
+    int out = 0;
+    int i;
+
+    srand (7);
+
+    buffer1 = malloc (N);
+    buffer2 = malloc (N);
+    rbuffer = malloc (M);
+
+    for (i = 0; i < N; i++)
+        buffer1[i] = i % 100;
+
+    ring_init (&ring, rbuffer, M);
+
+    while ((in + M) < N)
+    {
+        ring_span_t span;
+        ring_span_t spans[2];
+        int wsize;
+        int rsize;
+        int wbytes;
+        int rbytes;
+        int count;
+
+        wsize = rand () % M;
+        rsize = rand () % M;
+
+        /* Produce in place.  */
+        wbytes = ring_write_reserve (&ring, wsize, &span);
+        if (span.data != ring.in || wbytes > ring_write_num (&ring)
+            || span.data + wbytes > ring.end)
+        {
+            printf ("Bad reservation %d at in %d\n", wbytes, in);
+            return 1;
+        }
+        memcpy (span.data, &buffer1[in], wbytes);
+        ring_write_commit (&ring, wbytes);
+
+        /* Consume in place.  */
+        count = ring_read_peek (&ring, spans);
+        if (count != ring_read_num (&ring)
+            || spans[0].size + spans[1].size != count)
+        {
+            printf ("Bad peek %d at out %d\n", count, out);
+            return 1;
+        }
+        rbytes = rsize < count ? rsize : count;
+        if (rbytes <= spans[0].size)
+        {
+            memcpy (&buffer2[out], spans[0].data, rbytes);
+        }
+        else
+        {
+            memcpy (&buffer2[out], spans[0].data, spans[0].size);
+            memcpy (&buffer2[out + spans[0].size], spans[1].data,
+                    rbytes - spans[0].size);
+        }
+        ring_read_consume (&ring, rbytes);
+
+        if (memcmp (&buffer1[out], &buffer2[out], rbytes))
+        {
+            printf ("Mismatch at out %d\n", out);
+            return 1;
+        }
+
+        in += wbytes;
+        out += rbytes;
+    }
+
+    printf ("Transferred %d bytes\n", out);
+
+    free (buffer1);
+    free (buffer2);
+    free (rbuffer);
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <stdint.h>
+
+typedef uint8_t bool;
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "../ring_spsc.h"
+
+/* Number of bytes to pass between the threads.  */
+#define N 200000UL
+
+#define M 4096
+
+
+static ring_spsc_t ring;
+static int block_mode;
+static unsigned long errors;
+
+
+static double
+time_ns (void)
+{
+    struct timespec ts;
+
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+
+/* The producer writes a known byte sequence in random sized chunks.  */
+static void *
+producer (void *arg)
+{
+    unsigned long in = 0;
+    unsigned int seed = 7;
+    char buffer[512];
+
+    while (in < N)
+    {
+        unsigned int i;
+        unsigned int size;
+
+        if (!block_mode)
+        {
+            if (ring_spsc_putc (&ring, in & 0xff))
+                in++;
+            else
+                sched_yield ();
+            continue;
+        }
+
+        size = rand_r (&seed) % sizeof (buffer) + 1;
+        if (size > N - in)
+            size = N - in;
+        for (i = 0; i < size; i++)
+            buffer[i] = (in + i) & 0xff;
+
+        i = 0;
+        while (i < size)
+        {
+            unsigned int ret;
+
+            ret = ring_spsc_write (&ring, buffer + i, size - i);
+            if (!ret)
+                sched_yield ();
+            i += ret;
+        }
+        in += size;
+    }
+    return 0;
+}
+
+
+/* The consumer checks the sequence.  Any reordering of the index
+   and data accesses shows up as a mismatch.  */
+static void *
+consumer (void *arg)
+{
+    unsigned long out = 0;
+    unsigned int seed = 11;
+    char buffer[512];
+
+    while (out < N)
+    {
+        unsigned int i;
+        unsigned int size;
+        int c;
+
+        if (!block_mode)
+        {
+            c = ring_spsc_getc (&ring);
+            if (c == -1)
+            {
+                sched_yield ();
+                continue;
+            }
+            if ((char) c != (char) (out & 0xff))
+                errors++;
+            out++;
+            continue;
+        }
+
+        size = rand_r (&seed) % sizeof (buffer) + 1;
+        size = ring_spsc_read (&ring, buffer, size);
+        if (!size)
+            sched_yield ();
+        for (i = 0; i < size; i++)
+            if (buffer[i] != (char) ((out + i) & 0xff))
+                errors++;
+        out += size;
+    }
+    return 0;
+}
+
+
+static int
+run (const char *name)
+{
+    static char rbuffer[M];
+    pthread_t threads[2];
+    double start;
+    double elapsed;
+
+    ring_spsc_init (&ring, rbuffer, M);
+    errors = 0;
+
+    start = time_ns ();
+    pthread_create (&threads[0], 0, producer, 0);
+    pthread_create (&threads[1], 0, consumer, 0);
+    pthread_join (threads[0], 0);
+    pthread_join (threads[1], 0);
+    elapsed = time_ns () - start;
+
+    printf ("%-12s %lu bytes, %.2f ns/B, %.1f MB/s, %lu errors\n",
+            name, N, elapsed / N, N * 1e3 / elapsed, errors);
+
+    return errors != 0;
+}
+
+
+int main (void)
+{
+    int ret = 0;
+
+    block_mode = 1;
+    ret |= run ("write/read");
+
+    block_mode = 0;
+    ret |= run ("putc/getc");
+
+    return ret;
+}
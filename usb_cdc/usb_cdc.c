@@ -221,7 +221,7 @@ usb_cdc_write_callback (void *usb_cdc, usb_transfer_t *transfer)
 {
     usb_cdc_dev_t *dev = usb_cdc;    
 
-    ring_read_advance (&dev->tx_ring, transfer->transferred);
+    ring_read_consume (&dev->tx_ring, transfer->transferred);
     dev->writing = 0;
 
     if (transfer->status != USB_STATUS_SUCCESS)
@@ -234,16 +234,17 @@ usb_cdc_write_callback (void *usb_cdc, usb_transfer_t *transfer)
 static void
 usb_cdc_write_next (usb_cdc_dev_t *dev)
 {
-    int read_num;
+    ring_span_t spans[2];
 
-    read_num = ring_read_num_nowrap (&dev->tx_ring);
-    if (read_num == 0)
+    /* Send the first contiguous span straight out of the ring buffer
+       storage; the remainder is sent on completion.  */
+    if (ring_read_peek (&dev->tx_ring, spans) == 0)
         return;
 
     /* TODO fix possible race condition with shared variable writing.  */
 
     dev->writing = 1;
-    if (usb_write_async (dev->usb, dev->tx_ring.out, read_num,
+    if (usb_write_async (dev->usb, spans[0].data, spans[0].size,
                          usb_cdc_write_callback, dev) != USB_STATUS_SUCCESS)
         dev->writing = 0;
 }